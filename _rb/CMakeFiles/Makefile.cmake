@@ -0,0 +1,141 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "include/sc_cf.h.in"
+  "schemas/sdai_ap214e3/CMakeLists.txt"
+  "/root/repo/cmake/FindLEMON.cmake"
+  "/root/repo/cmake/FindPERPLEX.cmake"
+  "/root/repo/cmake/FindRE2C.cmake"
+  "/root/repo/cmake/SC_Build_opts.cmake"
+  "/root/repo/cmake/SC_CXX_schema_macros.cmake"
+  "/root/repo/cmake/SC_Config_Headers.cmake"
+  "/root/repo/cmake/SC_Locale.cmake"
+  "/root/repo/cmake/SC_Outdirs.cmake"
+  "/root/repo/cmake/SC_Paths.cmake"
+  "/root/repo/cmake/SC_Regenerate.cmake"
+  "/root/repo/cmake/SC_Targets.cmake"
+  "/root/repo/cmake/cmake_uninstall.cmake.in"
+  "/root/repo/cmake/md5_gen.cmake.in"
+  "/root/repo/cmake/md5_verify.cmake.in"
+  "/root/repo/cmake/sc_version_string.cmake"
+  "/root/repo/cmake/schema_scanner/schemaScanner.cmake"
+  "/root/repo/data/CMakeLists.txt"
+  "/root/repo/data/ap214e3/AP214E3_2010.exp"
+  "/root/repo/doc/CMakeLists.txt"
+  "/root/repo/include/CMakeLists.txt"
+  "/root/repo/src/base/CMakeLists.txt"
+  "/root/repo/src/cldai/CMakeLists.txt"
+  "/root/repo/src/cleditor/CMakeLists.txt"
+  "/root/repo/src/cllazyfile/CMakeLists.txt"
+  "/root/repo/src/clstepcore/CMakeLists.txt"
+  "/root/repo/src/clutils/CMakeLists.txt"
+  "/root/repo/src/exp2cxx/CMakeLists.txt"
+  "/root/repo/src/exp2python/CMakeLists.txt"
+  "/root/repo/src/exppp/CMakeLists.txt"
+  "/root/repo/src/express/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseArguments.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePushCheckState.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "cmake_uninstall.cmake"
+  "include/sc_cf.h"
+  "sc_version_string.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/base/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/express/express_md5gen.cmake"
+  "src/express/express_verify.cmake"
+  "src/express/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/exppp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/exp2cxx/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/exp2python/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/clstepcore/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/cleditor/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/cldai/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/clutils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/cllazyfile/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "include/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "schema_scanner/AP214E3_2010.exp"
+  "data/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "schemas/sdai_ap214e3/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "doc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/uninstall.dir/DependInfo.cmake"
+  "CMakeFiles/version_string.dir/DependInfo.cmake"
+  "CMakeFiles/core.dir/DependInfo.cmake"
+  "src/base/CMakeFiles/base.dir/DependInfo.cmake"
+  "src/express/CMakeFiles/express_md5gen.dir/DependInfo.cmake"
+  "src/express/CMakeFiles/express_verify.dir/DependInfo.cmake"
+  "src/express/CMakeFiles/express.dir/DependInfo.cmake"
+  "src/express/CMakeFiles/check-express.dir/DependInfo.cmake"
+  "src/exppp/CMakeFiles/libexppp.dir/DependInfo.cmake"
+  "src/exppp/CMakeFiles/exppp.dir/DependInfo.cmake"
+  "src/exp2cxx/CMakeFiles/exp2cxx.dir/DependInfo.cmake"
+  "src/clstepcore/CMakeFiles/stepcore.dir/DependInfo.cmake"
+  "src/cleditor/CMakeFiles/stepeditor.dir/DependInfo.cmake"
+  "src/cldai/CMakeFiles/stepdai.dir/DependInfo.cmake"
+  "src/clutils/CMakeFiles/steputils.dir/DependInfo.cmake"
+  "src/cllazyfile/CMakeFiles/steplazyfile.dir/DependInfo.cmake"
+  "src/cllazyfile/CMakeFiles/lazy_test.dir/DependInfo.cmake"
+  "data/CMakeFiles/bench.dir/DependInfo.cmake"
+  "schemas/sdai_ap214e3/CMakeFiles/generate_cpp_sdai_ap214e3.dir/DependInfo.cmake"
+  "schemas/sdai_ap214e3/CMakeFiles/sdai_ap214e3.dir/DependInfo.cmake"
+  "schemas/sdai_ap214e3/CMakeFiles/p21read_sdai_ap214e3.dir/DependInfo.cmake"
+  "schemas/sdai_ap214e3/CMakeFiles/p21scale_sdai_ap214e3.dir/DependInfo.cmake"
+  "schemas/sdai_ap214e3/CMakeFiles/lazy_sdai_ap214e3.dir/DependInfo.cmake"
+  "schemas/sdai_ap214e3/CMakeFiles/bench_sdai_ap214e3.dir/DependInfo.cmake"
+  "schemas/sdai_ap214e3/CMakeFiles/run_bench_sdai_ap214e3.dir/DependInfo.cmake"
+  )
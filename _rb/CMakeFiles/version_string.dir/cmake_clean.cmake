@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/version_string"
+  "ver_string"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/version_string.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,89 @@
+# Install script for directory: /root/repo/include
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/stepcode/express" TYPE FILE FILES
+    "/root/repo/include/express/alg.h"
+    "/root/repo/include/express/basic.h"
+    "/root/repo/include/express/caseitem.h"
+    "/root/repo/include/express/dict.h"
+    "/root/repo/include/express/entity.h"
+    "/root/repo/include/express/error.h"
+    "/root/repo/include/express/expbasic.h"
+    "/root/repo/include/express/expr.h"
+    "/root/repo/include/express/express.h"
+    "/root/repo/include/express/hash.h"
+    "/root/repo/include/express/lexact.h"
+    "/root/repo/include/express/linklist.h"
+    "/root/repo/include/express/memory.h"
+    "/root/repo/include/express/object.h"
+    "/root/repo/include/express/resolve.h"
+    "/root/repo/include/express/schema.h"
+    "/root/repo/include/express/scope.h"
+    "/root/repo/include/express/stmt.h"
+    "/root/repo/include/express/symbol.h"
+    "/root/repo/include/express/type.h"
+    "/root/repo/include/express/variable.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/stepcode/exppp" TYPE FILE FILES "/root/repo/include/exppp/exppp.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/stepcode" TYPE FILE FILES
+    "/root/repo/include/ordered_attrs.h"
+    "/root/repo/include/sc_export.h"
+    "/root/repo/include/sc_stdbool.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/stepcode" TYPE FILE FILES
+    "/root/repo/_rb/include/sc_cf.h"
+    "/root/repo/_rb/include/sc_version_string.h"
+    )
+endif()
+
@@ -0,0 +1,36 @@
+#ifndef SCL_CF_H
+#define SCL_CF_H
+
+/**** Define statements for CMake ****/
+/* #undef HAVE_NDIR_H */
+#define HAVE_STDARG_H 1
+#define HAVE_SYS_STAT_H 1
+#define HAVE_SYS_PARAM_H 1
+/* #undef HAVE_SYSENT_H */
+#define HAVE_UNISTD_H 1
+#define HAVE_DIRENT_H 1
+#define HAVE_STDBOOL_H 1
+/* #undef HAVE_PROCESS_H */
+/* #undef HAVE_IO_H */
+#define HAVE_SYS_WAIT_H 1
+
+/* #undef SC_TRACE_FPRINTF */
+/* #undef SC_MEMMGR_ENABLE_CHECKS */
+#define SC_ENTITY_STATS 1
+/* #undef SC_ENTITY_STATS_MALLOC_SIZES */
+
+#define HAVE_ABS 1
+#define HAVE_MEMCPY 1
+#define HAVE_MEMMOVE 1
+#define HAVE_GETOPT 1
+#define HAVE_FORK 1
+#define HAVE_OPEN_MEMSTREAM 1
+
+#define HAVE_SSIZE_T 1
+#define SC_THREAD_LOCAL __thread
+
+#define HAVE_STD_THREAD 1
+#define HAVE_STD_CHRONO 1
+#define HAVE_NULLPTR 1
+
+#endif /* SCL_CF_H */